@@ -0,0 +1,31 @@
+/* A program that exercises the rewrites of the
+syntax tree optimiser: constant folding, identities
+and strength reduction of array index products. */
+int a[100];
+int g;
+int f(int x) { g = g + 1; return x; }
+void main(void)
+{ int i; int s; int k; int j;
+  i = 0;
+  while (i < 10)
+  { a[i*2] = i + 0 * 5;
+    a[i*2+1] = 2*i*1;
+    j = 0;
+    while (j < 3) { a[50 + j*3] = a[j*3+1] + a[3*j] + i; j = j + 1; }
+    i = i + 1;
+  }
+  i = 9; s = 0;
+  while (i > 0) { s = s + a[2*i] + a[i*2+1] + a[i*2] * (4*8 - 30)*1; i = i - 1; }
+  output(s);
+  k = 3;
+  output((k+4)+5 - 2);
+  output(((k-4)-5) + 9);
+  output(k*0 + 1/1 + 0);
+  output(input() * 1 + 0);
+  output(f(k) * 0 + g);
+  output(7 / 2 + 8 - 3 * 4 + (1 < 2) + (3 == 4) + (2 >= 2));
+  output(0 + k * 1 - 0);
+  i = 0;
+  while (i < 5) { g = g + a[i*4] + f(a[4*i]); i = i + 1; }
+  output(g);
+}
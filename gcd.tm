@@ -0,0 +1,106 @@
+* C- Compilation to TM Code
+* File: gcd.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+  2:     ST  6,0(6) 	store mp for main
+  3:    LDA  0,1(7) 	return address
+  4:    LDA  7,43(7) 	jump to main
+  5:   HALT  0,0,0 	
+* End of standard prelude.
+* -> Function gcd
+* line 4
+  6:     ST  0,-1(6) 	func: store return address
+* line 6
+* -> if
+* -> Op
+  7:     LD  0,-3(6) 	load id value
+  8:     ST  0,-4(6) 	op: push left
+  9:    LDC  0,0(0) 	load const
+ 10:     LD  1,-4(6) 	op: load left
+ 11:    SUB  0,1,0 	op ==
+ 12:    JEQ  0,2(7) 	br if true
+ 13:    LDC  0,0(0) 	false case
+ 14:    LDA  7,1(7) 	unconditional jmp
+ 15:    LDC  0,1(0) 	true case
+* <- Op
+ 16:    JEQ  0,5(7) 	if: jmp to else
+* line 7
+* -> return
+ 17:     LD  0,-2(6) 	load id value
+ 18:     LD  1,-1(6) 	ret: load return address
+ 19:     LD  6,0(6) 	ret: pop frame
+ 20:    LDA  7,0(1) 	ret: jump back
+* <- return
+ 21:    LDA  7,23(7) 	if: jmp to end
+* line 9
+* -> return
+* -> Call gcd
+ 22:     LD  0,-3(6) 	load id value
+ 23:     ST  0,-6(6) 	call: store arg 0
+* -> Op
+ 24:     LD  0,-2(6) 	load id value
+ 25:     ST  0,-8(6) 	op: push left
+* -> Op
+* -> Op
+ 26:     LD  0,-2(6) 	load id value
+ 27:     ST  0,-9(6) 	op: push left
+ 28:     LD  0,-3(6) 	load id value
+ 29:     LD  1,-9(6) 	op: load left
+ 30:    DIV  0,1,0 	op /
+* <- Op
+ 31:     ST  0,-9(6) 	op: push left
+ 32:     LD  0,-3(6) 	load id value
+ 33:     LD  1,-9(6) 	op: load left
+ 34:    MUL  0,1,0 	op *
+* <- Op
+ 35:     LD  1,-8(6) 	op: load left
+ 36:    SUB  0,1,0 	op -
+* <- Op
+ 37:     ST  0,-7(6) 	call: store arg 1
+ 38:     ST  6,-4(6) 	call: store old mp
+ 39:    LDA  6,-4(6) 	call: push frame
+ 40:    LDA  0,1(7) 	call: return address
+ 41:    LDA  7,-36(7) 	call: jump to gcd
+* <- Call
+ 42:     LD  1,-1(6) 	ret: load return address
+ 43:     LD  6,0(6) 	ret: pop frame
+ 44:    LDA  7,0(1) 	ret: jump back
+* <- return
+* <- if
+* line 4
+ 45:     LD  1,-1(6) 	ret: load return address
+ 46:     LD  6,0(6) 	ret: pop frame
+ 47:    LDA  7,0(1) 	ret: jump back
+* <- Function gcd
+* -> Function main
+* line 13
+ 48:     ST  0,-1(6) 	func: store return address
+* line 16
+* -> assign
+ 49:     IN  0,0,0 	read integer value
+ 50:     ST  0,-2(6) 	assign: store value
+* <- assign
+* line 17
+* -> assign
+ 51:     IN  0,0,0 	read integer value
+ 52:     ST  0,-3(6) 	assign: store value
+* <- assign
+* line 18
+* -> Call gcd
+ 53:     LD  0,-2(6) 	load id value
+ 54:     ST  0,-6(6) 	call: store arg 0
+ 55:     LD  0,-3(6) 	load id value
+ 56:     ST  0,-7(6) 	call: store arg 1
+ 57:     ST  6,-4(6) 	call: store old mp
+ 58:    LDA  6,-4(6) 	call: push frame
+ 59:    LDA  0,1(7) 	call: return address
+ 60:    LDA  7,-55(7) 	call: jump to gcd
+* <- Call
+ 61:    OUT  0,0,0 	write ac
+* line 13
+ 62:     LD  1,-1(6) 	ret: load return address
+ 63:     LD  6,0(6) 	ret: pop frame
+ 64:    LDA  7,0(1) 	ret: jump back
+* <- Function main
+* End of execution.
@@ -0,0 +1,325 @@
+* C- Compilation to TM Code
+* File: sort.tm
+* Standard prelude:
+  0:     LD  6,0(0) 	load maxaddress from location 0
+  1:     ST  0,0(0) 	clear location 0
+  2:     ST  6,0(6) 	store mp for main
+  3:    LDA  0,1(7) 	return address
+  4:    LDA  7,134(7) 	jump to main
+  5:   HALT  0,0,0 	
+* End of standard prelude.
+* -> Function minloc
+* line 4
+  6:     ST  0,-1(6) 	func: store return address
+* line 6
+* -> assign
+  7:     LD  0,-3(6) 	load id value
+  8:     ST  0,-7(6) 	assign: store value
+* <- assign
+* line 7
+* -> assign
+  9:     LD  0,-2(6) 	load array base a
+ 10:     ST  0,-8(6) 	idx: push base
+ 11:     LD  0,-3(6) 	load id value
+ 12:     LD  1,-8(6) 	idx: load base
+ 13:    ADD  0,1,0 	idx: element address
+ 14:     LD  0,0(0) 	load array element
+ 15:     ST  0,-6(6) 	assign: store value
+* <- assign
+* line 8
+* -> assign
+* -> Op
+ 16:     LD  0,-3(6) 	load id value
+ 17:     ST  0,-8(6) 	op: push left
+ 18:    LDC  0,1(0) 	load const
+ 19:     LD  1,-8(6) 	op: load left
+ 20:    ADD  0,1,0 	op +
+* <- Op
+ 21:     ST  0,-5(6) 	assign: store value
+* <- assign
+* line 9
+* -> while
+* -> Op
+ 22:     LD  0,-5(6) 	load id value
+ 23:     ST  0,-8(6) 	op: push left
+ 24:     LD  0,-4(6) 	load id value
+ 25:     LD  1,-8(6) 	op: load left
+ 26:    SUB  0,1,0 	op <
+ 27:    JLT  0,2(7) 	br if true
+ 28:    LDC  0,0(0) 	false case
+ 29:    LDA  7,1(7) 	unconditional jmp
+ 30:    LDC  0,1(0) 	true case
+* <- Op
+ 31:    JEQ  0,32(7) 	while: jmp to end
+* line 10
+* -> if
+* -> Op
+ 32:     LD  0,-2(6) 	load array base a
+ 33:     ST  0,-8(6) 	idx: push base
+ 34:     LD  0,-5(6) 	load id value
+ 35:     LD  1,-8(6) 	idx: load base
+ 36:    ADD  0,1,0 	idx: element address
+ 37:     LD  0,0(0) 	load array element
+ 38:     ST  0,-8(6) 	op: push left
+ 39:     LD  0,-6(6) 	load id value
+ 40:     LD  1,-8(6) 	op: load left
+ 41:    SUB  0,1,0 	op <
+ 42:    JLT  0,2(7) 	br if true
+ 43:    LDC  0,0(0) 	false case
+ 44:    LDA  7,1(7) 	unconditional jmp
+ 45:    LDC  0,1(0) 	true case
+* <- Op
+ 46:    JEQ  0,10(7) 	if: jmp to else
+* line 11
+* -> assign
+ 47:     LD  0,-2(6) 	load array base a
+ 48:     ST  0,-8(6) 	idx: push base
+ 49:     LD  0,-5(6) 	load id value
+ 50:     LD  1,-8(6) 	idx: load base
+ 51:    ADD  0,1,0 	idx: element address
+ 52:     LD  0,0(0) 	load array element
+ 53:     ST  0,-6(6) 	assign: store value
+* <- assign
+* line 12
+* -> assign
+ 54:     LD  0,-5(6) 	load id value
+ 55:     ST  0,-7(6) 	assign: store value
+* <- assign
+ 56:    LDA  7,0(7) 	if: jmp to end
+* <- if
+* line 13
+* -> assign
+* -> Op
+ 57:     LD  0,-5(6) 	load id value
+ 58:     ST  0,-8(6) 	op: push left
+ 59:    LDC  0,1(0) 	load const
+ 60:     LD  1,-8(6) 	op: load left
+ 61:    ADD  0,1,0 	op +
+* <- Op
+ 62:     ST  0,-5(6) 	assign: store value
+* <- assign
+* line 9
+ 63:    LDA  7,-42(7) 	while: jmp back to test
+* <- while
+* line 15
+* -> return
+ 64:     LD  0,-7(6) 	load id value
+ 65:     LD  1,-1(6) 	ret: load return address
+ 66:     LD  6,0(6) 	ret: pop frame
+ 67:    LDA  7,0(1) 	ret: jump back
+* <- return
+* line 4
+ 68:     LD  1,-1(6) 	ret: load return address
+ 69:     LD  6,0(6) 	ret: pop frame
+ 70:    LDA  7,0(1) 	ret: jump back
+* <- Function minloc
+* -> Function sort
+* line 17
+ 71:     ST  0,-1(6) 	func: store return address
+* line 19
+* -> assign
+ 72:     LD  0,-3(6) 	load id value
+ 73:     ST  0,-5(6) 	assign: store value
+* <- assign
+* line 20
+* -> while
+* -> Op
+ 74:     LD  0,-5(6) 	load id value
+ 75:     ST  0,-8(6) 	op: push left
+* -> Op
+ 76:     LD  0,-4(6) 	load id value
+ 77:     ST  0,-9(6) 	op: push left
+ 78:    LDC  0,1(0) 	load const
+ 79:     LD  1,-9(6) 	op: load left
+ 80:    SUB  0,1,0 	op -
+* <- Op
+ 81:     LD  1,-8(6) 	op: load left
+ 82:    SUB  0,1,0 	op <
+ 83:    JLT  0,2(7) 	br if true
+ 84:    LDC  0,0(0) 	false case
+ 85:    LDA  7,1(7) 	unconditional jmp
+ 86:    LDC  0,1(0) 	true case
+* <- Op
+ 87:    JEQ  0,48(7) 	while: jmp to end
+* line 22
+* -> assign
+* -> Call minloc
+ 88:     LD  0,-2(6) 	load id value
+ 89:     ST  0,-10(6) 	call: store arg 0
+ 90:     LD  0,-5(6) 	load id value
+ 91:     ST  0,-11(6) 	call: store arg 1
+ 92:     LD  0,-4(6) 	load id value
+ 93:     ST  0,-12(6) 	call: store arg 2
+ 94:     ST  6,-8(6) 	call: store old mp
+ 95:    LDA  6,-8(6) 	call: push frame
+ 96:    LDA  0,1(7) 	call: return address
+ 97:    LDA  7,-92(7) 	call: jump to minloc
+* <- Call
+ 98:     ST  0,-6(6) 	assign: store value
+* <- assign
+* line 23
+* -> assign
+ 99:     LD  0,-2(6) 	load array base a
+100:     ST  0,-8(6) 	idx: push base
+101:     LD  0,-6(6) 	load id value
+102:     LD  1,-8(6) 	idx: load base
+103:    ADD  0,1,0 	idx: element address
+104:     LD  0,0(0) 	load array element
+105:     ST  0,-7(6) 	assign: store value
+* <- assign
+* line 24
+* -> assign
+106:     LD  0,-2(6) 	load array base a
+107:     ST  0,-8(6) 	idx: push base
+108:     LD  0,-6(6) 	load id value
+109:     LD  1,-8(6) 	idx: load base
+110:    ADD  0,1,0 	idx: element address
+111:     ST  0,-8(6) 	assign: push address
+112:     LD  0,-2(6) 	load array base a
+113:     ST  0,-9(6) 	idx: push base
+114:     LD  0,-5(6) 	load id value
+115:     LD  1,-9(6) 	idx: load base
+116:    ADD  0,1,0 	idx: element address
+117:     LD  0,0(0) 	load array element
+118:     LD  1,-8(6) 	assign: load address
+119:     ST  0,0(1) 	assign: store element
+* <- assign
+* line 25
+* -> assign
+120:     LD  0,-2(6) 	load array base a
+121:     ST  0,-8(6) 	idx: push base
+122:     LD  0,-5(6) 	load id value
+123:     LD  1,-8(6) 	idx: load base
+124:    ADD  0,1,0 	idx: element address
+125:     ST  0,-8(6) 	assign: push address
+126:     LD  0,-7(6) 	load id value
+127:     LD  1,-8(6) 	assign: load address
+128:     ST  0,0(1) 	assign: store element
+* <- assign
+* line 26
+* -> assign
+* -> Op
+129:     LD  0,-5(6) 	load id value
+130:     ST  0,-8(6) 	op: push left
+131:    LDC  0,1(0) 	load const
+132:     LD  1,-8(6) 	op: load left
+133:    ADD  0,1,0 	op +
+* <- Op
+134:     ST  0,-5(6) 	assign: store value
+* <- assign
+* line 20
+135:    LDA  7,-62(7) 	while: jmp back to test
+* <- while
+* line 17
+136:     LD  1,-1(6) 	ret: load return address
+137:     LD  6,0(6) 	ret: pop frame
+138:    LDA  7,0(1) 	ret: jump back
+* <- Function sort
+* -> Function main
+* line 29
+139:     ST  0,-1(6) 	func: store return address
+* line 31
+* -> assign
+140:    LDC  0,0(0) 	load const
+141:     ST  0,-2(6) 	assign: store value
+* <- assign
+* line 32
+* -> while
+* -> Op
+142:     LD  0,-2(6) 	load id value
+143:     ST  0,-3(6) 	op: push left
+144:    LDC  0,10(0) 	load const
+145:     LD  1,-3(6) 	op: load left
+146:    SUB  0,1,0 	op <
+147:    JLT  0,2(7) 	br if true
+148:    LDC  0,0(0) 	false case
+149:    LDA  7,1(7) 	unconditional jmp
+150:    LDC  0,1(0) 	true case
+* <- Op
+151:    JEQ  0,16(7) 	while: jmp to end
+* line 33
+* -> assign
+152:    LDA  0,0(5) 	load array base x
+153:     ST  0,-3(6) 	idx: push base
+154:     LD  0,-2(6) 	load id value
+155:     LD  1,-3(6) 	idx: load base
+156:    ADD  0,1,0 	idx: element address
+157:     ST  0,-3(6) 	assign: push address
+158:     IN  0,0,0 	read integer value
+159:     LD  1,-3(6) 	assign: load address
+160:     ST  0,0(1) 	assign: store element
+* <- assign
+* line 34
+* -> assign
+* -> Op
+161:     LD  0,-2(6) 	load id value
+162:     ST  0,-3(6) 	op: push left
+163:    LDC  0,1(0) 	load const
+164:     LD  1,-3(6) 	op: load left
+165:    ADD  0,1,0 	op +
+* <- Op
+166:     ST  0,-2(6) 	assign: store value
+* <- assign
+* line 32
+167:    LDA  7,-26(7) 	while: jmp back to test
+* <- while
+* line 36
+* -> Call sort
+168:    LDA  0,0(5) 	load address of array x
+169:     ST  0,-5(6) 	call: store arg 0
+170:    LDC  0,0(0) 	load const
+171:     ST  0,-6(6) 	call: store arg 1
+172:    LDC  0,10(0) 	load const
+173:     ST  0,-7(6) 	call: store arg 2
+174:     ST  6,-3(6) 	call: store old mp
+175:    LDA  6,-3(6) 	call: push frame
+176:    LDA  0,1(7) 	call: return address
+177:    LDA  7,-107(7) 	call: jump to sort
+* <- Call
+* line 37
+* -> assign
+178:    LDC  0,0(0) 	load const
+179:     ST  0,-2(6) 	assign: store value
+* <- assign
+* line 38
+* -> while
+* -> Op
+180:     LD  0,-2(6) 	load id value
+181:     ST  0,-3(6) 	op: push left
+182:    LDC  0,10(0) 	load const
+183:     LD  1,-3(6) 	op: load left
+184:    SUB  0,1,0 	op <
+185:    JLT  0,2(7) 	br if true
+186:    LDC  0,0(0) 	false case
+187:    LDA  7,1(7) 	unconditional jmp
+188:    LDC  0,1(0) 	true case
+* <- Op
+189:    JEQ  0,14(7) 	while: jmp to end
+* line 39
+190:    LDA  0,0(5) 	load array base x
+191:     ST  0,-3(6) 	idx: push base
+192:     LD  0,-2(6) 	load id value
+193:     LD  1,-3(6) 	idx: load base
+194:    ADD  0,1,0 	idx: element address
+195:     LD  0,0(0) 	load array element
+196:    OUT  0,0,0 	write ac
+* line 40
+* -> assign
+* -> Op
+197:     LD  0,-2(6) 	load id value
+198:     ST  0,-3(6) 	op: push left
+199:    LDC  0,1(0) 	load const
+200:     LD  1,-3(6) 	op: load left
+201:    ADD  0,1,0 	op +
+* <- Op
+202:     ST  0,-2(6) 	assign: store value
+* <- assign
+* line 38
+203:    LDA  7,-24(7) 	while: jmp back to test
+* <- while
+* line 29
+204:     LD  1,-1(6) 	ret: load return address
+205:     LD  6,0(6) 	ret: pop frame
+206:    LDA  7,0(1) 	ret: jump back
+* <- Function main
+* End of execution.